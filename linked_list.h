@@ -22,6 +22,26 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #ifndef LINKED_LIST_H
 #define LINKED_LIST_H
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Polymorphic memory resources (std::pmr) are available since C++17.
+#if (__cplusplus >= 201703L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 201703L))
+#include <memory_resource>
+#define LINKED_LIST_PMR_AVAILABLE
+#endif
+
+// Ranges are available since C++20. LinkedListView class is a range view only if the library provides them.
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#include <ranges>
+#endif
+
 
 using namespace std;
 
@@ -30,6 +50,8 @@ using namespace std;
 // *************************************************************************************************
 // Default array size for hash table that uses open hashing algorithm. 
 #define DEFAULT_HASH_TABLE_SIZE 10u
+// Default percentage of deleted items among all stored items triggering the compaction in lazy deletion mode.
+#define DEFAULT_COMPACTION_DELETED_PERCENT 50u
 
 // *************************************************************************************************
 // CLASS DECLARATIONS
@@ -37,8 +59,25 @@ using namespace std;
 // Forward declaration of LinkedList class so it can be specified as a friend in LinkedListItem class.
 // "T" is used as a custom type name, because this letter is commonly used for such purpose and it cannot
 // be mistaken for something else, since there is only one template type used.
-template <typename T>
+// "Allocator" is used for the allocation of the list items and of the scratch memory used by the loop detection.
+// "LazyDeletion" enables the lazy deletion mode support. Only such lists store the deleted flag in each item.
+template <typename T, typename Allocator = allocator<T>, bool LazyDeletion = false>
 class LinkedList;
+// Forward declarations of the linked list view classes. See LinkedListView class for more details.
+template <typename T, typename Allocator, bool LazyDeletion>
+class LinkedListItemsSource;
+template <typename Source>
+class LinkedListView;
+template <typename Source, typename Predicate>
+class LinkedListFilterSource;
+template <typename Source, typename Function>
+class LinkedListTransformSource;
+template <typename Source>
+class LinkedListTakeSource;
+template <typename Source>
+class LinkedListSkipSource;
+template <typename Function>
+class LinkedListFunctionBox;
 
 template <typename T>
 // Class representing one item of the linked list.
@@ -47,7 +86,11 @@ template <typename T>
 class LinkedListItem
 {
     // Ensuring that the linked list class has access to the private attributes of the linked list item.
-	friend class LinkedList<T>;
+    template <typename, typename, bool>
+    friend class LinkedList;
+    // Ensuring that the linked list view can read the items directly.
+    template <typename, typename, bool>
+    friend class LinkedListItemsSource;
 
     public:
         // Constructor directly setting the data of the list item.
@@ -67,16 +110,52 @@ class LinkedListItem
 };
 
 
+// Class representing one item of the linked list supporting the lazy deletion mode.
+// The deleted flag is kept in this derived class, so the lists without lazy deletion support do not
+// pay for it in every item. See LinkedList "LazyDeletion" template argument.
+template <typename T>
+class LinkedListDeletableItem : public LinkedListItem<T>
+{
+    // Ensuring that the linked list class has access to the deleted flag.
+    template <typename, typename, bool>
+    friend class LinkedList;
+
+    public:
+        // Constructor directly setting the data of the list item.
+        LinkedListDeletableItem(T);
+
+    private:
+        // Flag indicating that the item was deleted in lazy deletion mode and waits for the compaction.
+        bool deleted;
+};
+
+
 // Linked list class for linear lists of data. Each item represented by LinkedListItem object
 // consists of data (value) and a pointer to the next item.
-template <typename T>
+// The list items are allocated by the allocator rebound from the "Allocator" template argument
+// to the LinkedListItem type. See PmrLinkedList alias for the list using polymorphic memory resources.
+// If the "LazyDeletion" template argument is true, the list items are LinkedListDeletableItem objects
+// and the lazy deletion mode can be used. See LazyDeletionLinkedList alias.
+template <typename T, typename Allocator, bool LazyDeletion>
 class LinkedList
 {
     public:
         // Constructor creating empty list.
         LinkedList();
+        // Constructor creating empty list using the specified allocator.
+        explicit LinkedList(const Allocator &);
+        // Copy constructor creating a deep copy (clone) of the list items.
+        LinkedList(const LinkedList &);
+        // Move constructor taking over the list items of the other list.
+        LinkedList(LinkedList &&) noexcept;
         // Destructor deleting all list items from memory.
         ~LinkedList();
+        // Copy assignment replacing the list items by a deep copy (clone) of the other list items.
+        LinkedList& operator=(const LinkedList &);
+        // Move assignment replacing the list items by the list items of the other list.
+        // It cannot throw if the allocator propagates on move assignment or if all allocators of its type are equal.
+        LinkedList& operator=(LinkedList &&) noexcept(allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
+                                                      allocator_traits<Allocator>::is_always_equal::value);
         // Adds item with specified data at the end of the list.
         void AddItemAtEnd(const T);
         // Deletes first instance of an item having the specified data value.
@@ -98,8 +177,38 @@ class LinkedList
         bool IsLooping_TransitionCount();
         // Indicates if list is looping using Floyd's cycle detection algorithm.
         bool IsLooping_FloydsCycleFind();
+        // Enables or disables lazy deletion mode and sets the percentage of deleted items triggering the compaction.
+        void SetLazyDeletion(bool, unsigned int=DEFAULT_COMPACTION_DELETED_PERCENT);
+        // Unlinks and frees all items marked as deleted in lazy deletion mode.
+        void CompactItems();
+        // Returns copy of the allocator used by the list.
+        Allocator GetAllocator() const;
+        // Returns lazy view reading all list items. See LinkedListView class for more details.
+        LinkedListView<LinkedListItemsSource<T, Allocator, LazyDeletion>> View() const;
+        // Returns lazy view reading only the list items matching the predicate.
+        template <typename Predicate>
+        LinkedListView<LinkedListFilterSource<LinkedListItemsSource<T, Allocator, LazyDeletion>, Predicate>> Filter(Predicate) const;
+        // Returns lazy view reading the list items transformed by the function.
+        template <typename Function>
+        LinkedListView<LinkedListTransformSource<LinkedListItemsSource<T, Allocator, LazyDeletion>, Function>> Transform(Function) const;
+        // Returns lazy view reading at most the specified number of first list items.
+        LinkedListView<LinkedListTakeSource<LinkedListItemsSource<T, Allocator, LazyDeletion>>> Take(unsigned long) const;
+        // Returns lazy view reading the list items after the specified number of first list items.
+        LinkedListView<LinkedListSkipSource<LinkedListItemsSource<T, Allocator, LazyDeletion>>> Skip(unsigned long) const;
 
     private:
+        // Ensuring that the linked list view can read the list head and number of stored items.
+        template <typename, typename, bool>
+        friend class LinkedListItemsSource;
+
+        // Type of the list items, i.e. the item with the deleted flag only if the lazy deletion is supported.
+        using Item = typename conditional<LazyDeletion, LinkedListDeletableItem<T>, LinkedListItem<T>>::type;
+        // Allocator types and traits for the list items.
+        using ItemAllocator = typename allocator_traits<Allocator>::template rebind_alloc<Item>;
+        using ItemAllocatorTraits = allocator_traits<ItemAllocator>;
+
+        // Allocator used for the list items.
+        ItemAllocator item_allocator;
         // Pointers to the linked list head and tail.
         LinkedListItem<T> *p_head;
         LinkedListItem<T> *p_tail;
@@ -108,9 +217,329 @@ class LinkedList
         // Number of items in a list.
         // number_of_items = added_items_number - deleted_items_number
         unsigned long items_num;
+        // Block of items allocated at once when the list is cloned and its size.
+        Item *p_block;
+        unsigned long block_items_num;
+        // Flag indicating whether the lazy deletion mode is enabled.
+        bool lazy_deletion;
+        // Percentage of deleted items among all stored items triggering the compaction in lazy deletion mode.
+        unsigned int compaction_deleted_percent;
+        // Number of items marked as deleted, but still stored in the list until the compaction.
+        unsigned long deleted_items_num;
 
         // Utility function getting pointer to the current item with the specified data and also pointer to the previous item. 
         void GetCurrentPreviousItemPointer(const T, LinkedListItem<T> **, LinkedListItem<T> ** = nullptr);
+        // Utility function allocating and constructing new list item with the specified data.
+        LinkedListItem<T>* CreateItem(const T);
+        // Utility function destroying and deallocating the list item.
+        void DestroyItem(LinkedListItem<T> *);
+        // Utility function deleting all list items from memory and making the list empty.
+        void DeleteAllItems();
+        // Utility function copying all items of the other list into this empty list.
+        void CloneItems(const LinkedList &);
+        // Utility function taking over all items of the other list into this empty list.
+        void TakeOverItems(LinkedList &);
+        // Utility function freeing the cloned items block if there are no items stored in the list anymore.
+        void DeleteEmptyBlock();
+        // Utility function getting pointer to the first item of the list loop.
+        LinkedListItem<T>* GetLoopStartItem() const;
+        // Utility function cutting the list loop (if any) and returning pointer to the first item of the former loop.
+        LinkedListItem<T>* CutLoop();
+        // Utility function getting pointer to the first item not marked as deleted starting from the specified item.
+        LinkedListItem<T>* GetNotDeletedItem(LinkedListItem<T> *) const;
+        // Utility function returning number of all items stored in the list including the ones marked as deleted.
+        unsigned long GetStoredItemsNum() const;
+        // Utility functions indicating whether the item is marked as deleted, either with (true_type) or without (false_type)
+        // lazy deletion support.
+        static bool IsItemDeleted(const LinkedListItem<T> *);
+        static bool IsItemDeleted(const LinkedListItem<T> *, true_type);
+        static bool IsItemDeleted(const LinkedListItem<T> *, false_type);
+        // Utility functions marking the item as deleted, either with (true_type) or without (false_type) lazy deletion support.
+        static void SetItemDeleted(LinkedListItem<T> *);
+        static void SetItemDeleted(LinkedListItem<T> *, true_type);
+        static void SetItemDeleted(LinkedListItem<T> *, false_type);
+        // Utility functions replacing the list allocator by the other allocator if it propagates (true_type) or not (false_type).
+        void PropagateAllocator(const ItemAllocator &, true_type);
+        void PropagateAllocator(const ItemAllocator &, false_type);
+};
+
+
+// Linked list supporting the lazy deletion mode, which is enabled by default. See LinkedList::SetLazyDeletion method.
+template <typename T, typename Allocator = allocator<T>>
+using LazyDeletionLinkedList = LinkedList<T, Allocator, true>;
+
+
+#ifdef LINKED_LIST_PMR_AVAILABLE
+// Linked list allocating its items from a polymorphic memory resource, e.g.:
+//
+//     pmr::monotonic_buffer_resource arena;
+//     PmrLinkedList<int> linked_list(&arena);
+//
+// Note:
+//    The memory resource must outlive the list.
+template <typename T>
+using PmrLinkedList = LinkedList<T, pmr::polymorphic_allocator<T>>;
+#endif
+
+
+// Lazy view over the linked list items. Views are created by the View, Filter, Transform, Take and Skip methods
+// of the LinkedList class and can be further chained by the same methods of this class, e.g.:
+//
+//     LinkedList<int> squares = linked_list.Filter(IsEven).Transform(Square).Take(3u).Collect();
+//
+// Chained views do not read anything and do not allocate any memory when they are created. Each view only wraps
+// the source of the previous view, so the items are read by a single traversal through the list, one item at
+// a time, only when the view is collected or iterated using its begin and end methods (e.g. in a range-based
+// for loop). Views provide input iterators. If C++20 ranges are available, the view is derived from
+// std::ranges::view_interface, so it models std::ranges::view and can be combined with the standard range
+// adaptors and algorithms, e.g. "linked_list.Filter(IsEven) | std::views::take(3)". Lambdas stored by the views
+// are wrapped in LinkedListFunctionBox, so the views are assignable as required by the view concept.
+//
+// Note:
+//    A view can be traversed only once, like an input stream. Create a new view to traverse the list again.
+//    The list must not be changed while its view is being traversed.
+//    Traversal of a looped list stops after the number of transitions equal to the number of stored items
+//    (the same way as in LinkedList::GetCurrentPreviousItemPointer), so the view always ends. Take view
+//    stops reading its source as soon as the requested number of items is read.
+//
+// "Source" is a class providing the "value_type" type and the "bool ReadItem(value_type &)" method reading data of
+// the next item through the reference argument. Return value indicates if the item was read, i.e. false is
+// returned at the end of the source and after it.
+template <typename Source>
+class LinkedListView
+#ifdef __cpp_lib_ranges
+    : public ranges::view_interface<LinkedListView<Source>>
+#endif
+{
+    public:
+        // Type of the data read by the view.
+        using value_type = typename Source::value_type;
+
+        // Input iterator reading the view items.
+        class Iterator
+        {
+            public:
+                using iterator_category = input_iterator_tag;
+                using value_type = typename Source::value_type;
+                using difference_type = ptrdiff_t;
+                using pointer = const value_type *;
+                using reference = const value_type &;
+
+                // Proxy returned by the postfix increment keeping the data of the item read before the increment,
+                // because the view (and therefore also the iterator) holds only the data of the current item.
+                class PostIncrementProxy
+                {
+                    public:
+                        // Constructor saving the item data.
+                        explicit PostIncrementProxy(reference);
+                        // Returns the saved item data.
+                        reference operator*() const;
+
+                    private:
+                        // Saved item data.
+                        value_type data;
+                };
+
+                // Constructor creating end iterator.
+                Iterator();
+                // Constructor creating iterator reading the specified view.
+                explicit Iterator(LinkedListView *);
+                // Returns the data of the current item.
+                reference operator*() const;
+                // Returns pointer to the data of the current item.
+                pointer operator->() const;
+                // Moves to the next item.
+                Iterator& operator++();
+                // Moves to the next item and returns proxy holding the data of the previous item (supports "*it++").
+                PostIncrementProxy operator++(int);
+                // Iterators are equal if both are at the end, otherwise only if they are the same iterator.
+                bool operator==(const Iterator &) const;
+                bool operator!=(const Iterator &) const;
+
+            private:
+                // View read by the iterator. Null pointer for the end iterator.
+                LinkedListView *p_view;
+
+                // Indicates whether the iterator is at the end of the view.
+                bool IsAtEnd() const;
+        };
+
+        // Constructor creating empty view. Required by the C++20 view concept in older standard libraries.
+        LinkedListView();
+        // Constructor creating view reading the specified source.
+        explicit LinkedListView(const Source &);
+        // Returns lazy view reading only the items matching the predicate.
+        template <typename Predicate>
+        LinkedListView<LinkedListFilterSource<Source, Predicate>> Filter(Predicate) const;
+        // Returns lazy view reading the items transformed by the function.
+        template <typename Function>
+        LinkedListView<LinkedListTransformSource<Source, Function>> Transform(Function) const;
+        // Returns lazy view reading at most the specified number of first items.
+        LinkedListView<LinkedListTakeSource<Source>> Take(unsigned long) const;
+        // Returns lazy view reading the items after the specified number of first items.
+        LinkedListView<LinkedListSkipSource<Source>> Skip(unsigned long) const;
+        // Reads all remaining items of the view into a new linked list.
+        template <typename CollectAllocator = allocator<value_type>>
+        LinkedList<value_type, CollectAllocator> Collect(const CollectAllocator & = CollectAllocator());
+        // Returns iterator reading the view items. Lowercase name is required by the range-based for loop.
+        Iterator begin();
+        // Returns end iterator.
+        Iterator end();
+
+    private:
+        // Source of the view items.
+        Source source;
+        // Data of the current item read by the iterator.
+        value_type current_data;
+        // Flag indicating whether the current item data was read, i.e. if the end of the source was not reached.
+        bool current_read;
+};
+
+
+// Source of the view reading the items directly from the linked list. Items marked as deleted are skipped.
+template <typename T, typename Allocator, bool LazyDeletion>
+class LinkedListItemsSource
+{
+    public:
+        // Type of the data read by the source.
+        using value_type = T;
+
+        // Constructor creating source reading no items.
+        LinkedListItemsSource();
+        // Constructor creating source reading the list from its head item.
+        explicit LinkedListItemsSource(const LinkedList<T, Allocator, LazyDeletion> &);
+        // Reads data of the next item. Return value indicates if the item was read.
+        bool ReadItem(T &);
+
+    private:
+        // Pointer to the next item to be read.
+        const LinkedListItem<T> *p_current;
+        // Number of transitions left before the traversal is stopped to avoid endless reading of a looped list.
+        unsigned long transitions_left;
+};
+
+
+// Source of the view reading only the items of another source matching the predicate.
+template <typename Source, typename Predicate>
+class LinkedListFilterSource
+{
+    public:
+        // Type of the data read by the source.
+        using value_type = typename Source::value_type;
+
+        // Constructor creating source reading no items.
+        LinkedListFilterSource();
+        // Constructor creating source reading the other source through the predicate.
+        LinkedListFilterSource(const Source &, Predicate);
+        // Reads data of the next item matching the predicate. Return value indicates if the item was read.
+        bool ReadItem(value_type &);
+
+    private:
+        // Other source of the items.
+        Source source;
+        // Predicate returning true for the items to be read.
+        LinkedListFunctionBox<Predicate> predicate;
+};
+
+
+// Source of the view reading the items of another source transformed by the function.
+template <typename Source, typename Function>
+class LinkedListTransformSource
+{
+    public:
+        // Type of the data read by the source, i.e. type returned by the function for the item data of the other source.
+        using value_type = typename decay<decltype(declval<Function &>()(declval<const typename Source::value_type &>()))>::type;
+
+        // Constructor creating source reading no items.
+        LinkedListTransformSource();
+        // Constructor creating source reading the other source through the function.
+        LinkedListTransformSource(const Source &, Function);
+        // Reads data of the next item transformed by the function. Return value indicates if the item was read.
+        bool ReadItem(value_type &);
+
+    private:
+        // Other source of the items.
+        Source source;
+        // Function transforming the item data.
+        LinkedListFunctionBox<Function> function;
+};
+
+
+// Source of the view reading at most the specified number of first items of another source.
+template <typename Source>
+class LinkedListTakeSource
+{
+    public:
+        // Type of the data read by the source.
+        using value_type = typename Source::value_type;
+
+        // Constructor creating source reading no items.
+        LinkedListTakeSource();
+        // Constructor creating source reading at most the specified number of items of the other source.
+        LinkedListTakeSource(const Source &, unsigned long);
+        // Reads data of the next item unless all requested items were read. Return value indicates if the item was read.
+        bool ReadItem(value_type &);
+
+    private:
+        // Other source of the items.
+        Source source;
+        // Number of items that can still be read.
+        unsigned long items_left;
+};
+
+
+// Source of the view reading the items of another source after the specified number of first items.
+template <typename Source>
+class LinkedListSkipSource
+{
+    public:
+        // Type of the data read by the source.
+        using value_type = typename Source::value_type;
+
+        // Constructor creating source reading no items.
+        LinkedListSkipSource();
+        // Constructor creating source skipping the specified number of first items of the other source.
+        LinkedListSkipSource(const Source &, unsigned long);
+        // Reads data of the next item after the skipped ones. Return value indicates if the item was read.
+        bool ReadItem(value_type &);
+
+    private:
+        // Other source of the items.
+        Source source;
+        // Number of items that still have to be skipped.
+        unsigned long items_to_skip;
+};
+
+
+// Wrapper of the function object (e.g. lambda) used by the view sources. Lambdas cannot be assigned, but C++20
+// range views must be assignable. The wrapper is therefore assigned by destroying its function object and
+// copy-constructing the other one in its place.
+template <typename Function>
+class LinkedListFunctionBox
+{
+    public:
+        // Constructor creating empty wrapper. Empty wrapper must not be called.
+        LinkedListFunctionBox();
+        // Constructor storing copy of the function object.
+        explicit LinkedListFunctionBox(const Function &);
+        // Copy constructor storing copy of the other function object.
+        LinkedListFunctionBox(const LinkedListFunctionBox &);
+        // Destructor destroying the stored function object.
+        ~LinkedListFunctionBox();
+        // Copy assignment replacing the stored function object by copy of the other function object.
+        LinkedListFunctionBox& operator=(const LinkedListFunctionBox &);
+        // Calls the stored function object with the specified arguments.
+        template <typename... Arguments>
+        auto operator()(Arguments &&...) -> decltype(declval<Function &>()(declval<Arguments>()...));
+
+    private:
+        // Memory for the stored function object.
+        alignas(Function) unsigned char a_storage[sizeof(Function)];
+        // Pointer to the function object stored in the memory above or null pointer if the wrapper is empty.
+        Function *p_function;
+
+        // Utility function destroying the stored function object (if any) and making the wrapper empty.
+        void DestroyFunction();
 };
 
 
@@ -135,58 +564,115 @@ LinkedListItem<T>::~LinkedListItem()
 }
 
 
-// Constructor creating empty list.
+// Constructor directly setting the data of the list item, which is not marked as deleted.
 template <typename T>
-LinkedList<T>::LinkedList()
+LinkedListDeletableItem<T>::LinkedListDeletableItem(T data) : LinkedListItem<T>(data)
+{
+    this->deleted = false;
+}
+
+
+// Constructor creating empty list.
+template <typename T, typename Allocator, bool LazyDeletion>
+LinkedList<T, Allocator, LazyDeletion>::LinkedList() : LinkedList(Allocator())
+{
+}
+
+
+// Constructor creating empty list using the specified allocator.
+template <typename T, typename Allocator, bool LazyDeletion>
+LinkedList<T, Allocator, LazyDeletion>::LinkedList(const Allocator &allocator) : item_allocator(allocator)
 {
     // Init all list item pointers to null creating an empty list.
     this->p_head = nullptr;
     this->p_tail = nullptr;
     this->p_listing = nullptr;
     this->items_num = 0u;
+    this->p_block = nullptr;
+    this->block_items_num = 0u;
+    this->lazy_deletion = LazyDeletion;
+    this->compaction_deleted_percent = DEFAULT_COMPACTION_DELETED_PERCENT;
+    this->deleted_items_num = 0u;
+}
+
+
+// Copy constructor creating a deep copy (clone) of the list items.
+// See CloneItems method for more details.
+template <typename T, typename Allocator, bool LazyDeletion>
+LinkedList<T, Allocator, LazyDeletion>::LinkedList(const LinkedList &other) :
+    LinkedList(Allocator(ItemAllocatorTraits::select_on_container_copy_construction(other.item_allocator)))
+{
+    this->CloneItems(other);
+}
+
+
+// Move constructor taking over the list items of the other list. The other list is left empty.
+template <typename T, typename Allocator, bool LazyDeletion>
+LinkedList<T, Allocator, LazyDeletion>::LinkedList(LinkedList &&other) noexcept : LinkedList(Allocator(other.item_allocator))
+{
+    this->TakeOverItems(other);
 }
 
 
 // Destructor deleting all list items from memory.
-template <typename T>
-LinkedList<T>::~LinkedList()
+template <typename T, typename Allocator, bool LazyDeletion>
+LinkedList<T, Allocator, LazyDeletion>::~LinkedList()
 {
-    LinkedListItem<T> *p_current;   // Pointer used for traversing the list.
-    LinkedListItem<T> *p_next;      // Temporary pointer to the next item.
+    this->DeleteAllItems();
+}
 
 
-    p_current = this->p_head;
+// Copy assignment replacing the list items by a deep copy (clone) of the other list items.
+template <typename T, typename Allocator, bool LazyDeletion>
+LinkedList<T, Allocator, LazyDeletion>& LinkedList<T, Allocator, LazyDeletion>::operator=(const LinkedList &other)
+{
+    if(this != &other)
+    {
+        // Delete the current items using the current allocator before it is possibly replaced.
+        this->DeleteAllItems();
+        this->PropagateAllocator(other.item_allocator, typename ItemAllocatorTraits::propagate_on_container_copy_assignment());
+        this->CloneItems(other);
+    }
 
-    // Loop through the list until the end of the list is found, i.e. null pointer.
-    while(p_current != nullptr)
+    return *this;
+}
+
+
+// Move assignment replacing the list items by the list items of the other list. The other list is left empty.
+// The items are taken over in O(1) time if the allocator propagates or if both allocators are equal. Otherwise the items
+// allocated by the other allocator cannot be freed by this list allocator, so they are cloned instead. Only the cloning
+// can throw, so the assignment is noexcept if the allocators always propagate or are always equal.
+template <typename T, typename Allocator, bool LazyDeletion>
+LinkedList<T, Allocator, LazyDeletion>& LinkedList<T, Allocator, LazyDeletion>::operator=(LinkedList &&other)
+    noexcept(allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
+             allocator_traits<Allocator>::is_always_equal::value)
+{
+    if(this != &other)
     {
-        // Save next item to temporary pointer.
-        p_next = p_current->p_next;
-        // Set the next pointer of the current item to null, otherwise this while
-        // cycle will never end if the list is looped, because the null will
-        // never be detected.
-        // The next pointer is set to null in the list item desctructor, but it is
-        // not enough for some unknown reason. That'w why the next pointer is set to
-        // null also here.
-        // Note:
-        //    Beware that all the items cut-out after the list loop (if there is one)
-        //    will remain undeleted in memory, because no mechanism is implemented to
-        //    find them!
-        p_current->p_next = nullptr;
-        // Delete the current item.
-        delete p_current;
-        // Move to the next item.
-        p_current = p_next;
+        this->DeleteAllItems();
+        this->PropagateAllocator(other.item_allocator, typename ItemAllocatorTraits::propagate_on_container_move_assignment());
+
+        if(this->item_allocator == other.item_allocator)
+        {
+            this->TakeOverItems(other);
+        }
+        else
+        {
+            this->CloneItems(other);
+            other.DeleteAllItems();
+        }
     }
+
+    return *this;
 }
 
 
-template <typename T>
+template <typename T, typename Allocator, bool LazyDeletion>
 // Adds item with specified data at the end of the list.
-void LinkedList<T>::AddItemAtEnd(const T data)
+void LinkedList<T, Allocator, LazyDeletion>::AddItemAtEnd(const T data)
 {
     // Allocate memory for new item.
-    LinkedListItem<T> *p_new = new LinkedListItem<T>(data);
+    LinkedListItem<T> *p_new = this->CreateItem(data);
 
     // Check if list is empty, i.e. head pointer is pointing to null.
     if(this->p_head == nullptr)
@@ -215,8 +701,11 @@ void LinkedList<T>::AddItemAtEnd(const T data)
 // Deletes first instance of an item having the specified data value.
 // The next point of the item before the deleted item is pointed to the item right after the
 // deleted item to keep the list continuos.
-template <typename T>
-void LinkedList<T>::DeleteItem(const T data_to_delete)
+// In lazy deletion mode the item is only marked as deleted, so the deletion costs just the item lookup.
+// Items marked as deleted are then unlinked and freed all at once by the CompactItems method when their
+// percentage among all stored items reaches the value set by the SetLazyDeletion method.
+template <typename T, typename Allocator, bool LazyDeletion>
+void LinkedList<T, Allocator, LazyDeletion>::DeleteItem(const T data_to_delete)
 {
     LinkedListItem<T> *p_current = nullptr;
     LinkedListItem<T> *p_previous = nullptr;
@@ -224,8 +713,25 @@ void LinkedList<T>::DeleteItem(const T data_to_delete)
     // Get pointer to the current and previous item for the specified data value.
     this->GetCurrentPreviousItemPointer(data_to_delete, &p_current, &p_previous);
 
+    // If current item having specified data value was found and lazy deletion mode is enabled.
+    if( (p_current != nullptr) && this->lazy_deletion )
+    {
+        // Mark the item as deleted and move it from the number of items to the number of deleted items.
+        this->SetItemDeleted(p_current);
+        if(this->items_num > 0u)
+        {
+            this->items_num--;
+        }
+        this->deleted_items_num++;
+
+        // Compact the list if the percentage of deleted items reached the configured limit.
+        if( (this->deleted_items_num * 100u) >= (this->compaction_deleted_percent * this->GetStoredItemsNum()) )
+        {
+            this->CompactItems();
+        }
+    }
     // If current item having specified data value was found.
-    if(p_current != nullptr)
+    else if(p_current != nullptr)
     {
         // If previous item before the one with specified data was found.
         if(p_previous != nullptr)
@@ -249,13 +755,16 @@ void LinkedList<T>::DeleteItem(const T data_to_delete)
         }
 
         // Delete the item with specified data value.
-        delete p_current;
+        this->DestroyItem(p_current);
 
         // Decrement number of items in the list while avoiding overflow.
         if(this->items_num > 0u)
         {
             this->items_num--;
         }
+
+        // Free the cloned items block if its last item was deleted.
+        this->DeleteEmptyBlock();
     } // end if(p_current != nullptr)
 }
 
@@ -263,22 +772,27 @@ void LinkedList<T>::DeleteItem(const T data_to_delete)
 // Get data of the next item through the reference argument. Starts at the head of the list and
 // moves to the next item after each call. Automatically keeps returning the last item data after
 // the end of the list is reached until the reading is reset to the beginning by the ResetReading method.
+// Items marked as deleted in lazy deletion mode are skipped.
 // Return value indicates if there are further items to be read, i.e. if the list still continues.
-template <typename T>
-bool LinkedList<T>::GetNextItem(T &data)
+template <typename T, typename Allocator, bool LazyDeletion>
+bool LinkedList<T, Allocator, LazyDeletion>::GetNextItem(T &data)
 {
     bool list_continues = false;    // Flag indicating whether there are further items to be read.
+    LinkedListItem<T> *p_next = nullptr;
 
     // this->p_listing pointer is used for iterating over the list items.
     // The listing pointer jumps to the next item during each call of this method and stops at the end item.
+    // Skip the items marked as deleted since the previous call.
+    this->p_listing = this->GetNotDeletedItem(this->p_listing);
     if(this->p_listing != nullptr)
     {
         // Set data value pointed to by the listing pointer.
         data = this->p_listing->data;
-        // Move the listing pointer to the next item unless it's already at the end.
-        if(this->p_listing->p_next != nullptr)
+        // Move the listing pointer to the next item not marked as deleted unless it's already at the end.
+        p_next = this->GetNotDeletedItem(this->p_listing->p_next);
+        if(p_next != nullptr)
         {
-            this->p_listing = this->p_listing->p_next;
+            this->p_listing = p_next;
             list_continues = true;
         }
     }
@@ -288,17 +802,17 @@ bool LinkedList<T>::GetNextItem(T &data)
 
 
 // Moves reading index used by GetNextItem method back to the list head item.
-template <typename T>
-void LinkedList<T>::ResetReading()
+template <typename T, typename Allocator, bool LazyDeletion>
+void LinkedList<T, Allocator, LazyDeletion>::ResetReading()
 {
     // Set listing pointer used by the GetNextItem method to the head item of the list.
     this->p_listing = this->p_head;
 }
 
 
-// Indicates whether item with specified data is present.
-template <typename T>
-bool LinkedList<T>::IsItemPresent(const T data)
+// Indicates whether item with specified data is present. Items marked as deleted are not considered present.
+template <typename T, typename Allocator, bool LazyDeletion>
+bool LinkedList<T, Allocator, LazyDeletion>::IsItemPresent(const T data)
 {
     LinkedListItem<T> *p_current = nullptr;
     bool item_present = false;
@@ -315,9 +829,9 @@ bool LinkedList<T>::IsItemPresent(const T data)
 }
 
 
-// Returns number of items in the linked list.
-template <typename T>
-unsigned long LinkedList<T>::GetItemsNum()
+// Returns number of items in the linked list. Items marked as deleted in lazy deletion mode are not counted.
+template <typename T, typename Allocator, bool LazyDeletion>
+unsigned long LinkedList<T, Allocator, LazyDeletion>::GetItemsNum()
 {
     return this->items_num;
 }
@@ -326,8 +840,8 @@ unsigned long LinkedList<T>::GetItemsNum()
 // Forcing a link from one item to another. To be used only for intentional creation of looped list.
 // Next pointer of the item with specified "data" value will be set to point to the item with specified
 // "next_data" value.
-template <typename T>
-void LinkedList<T>::SetNextReference(const T data, const T next_data)
+template <typename T, typename Allocator, bool LazyDeletion>
+void LinkedList<T, Allocator, LazyDeletion>::SetNextReference(const T data, const T next_data)
 {
     LinkedListItem<T> *p_current = nullptr;
     LinkedListItem<T> *p_next = nullptr;
@@ -362,9 +876,10 @@ void LinkedList<T>::SetNextReference(const T data, const T next_data)
 // with index 1 (linked_list[1]) is searched for value 4. 
 //
 // See https://www.log2base2.com/algorithms/searching/open-hashing.html for more information.
-// The hash table is created using new LinkedList object. This greatly simplifies the hashing
-// algorithm implementation. Hash table array size can be specified through the input argument.
-// The hash table then further grows with the amount of traversed list items.
+// The hash table is an array of LinkedList objects allocated and constructed by the list allocator,
+// so its items use the same memory as the list items. Using LinkedList objects greatly simplifies
+// the hashing algorithm implementation. Hash table array size can be specified through the input
+// argument. The hash table then further grows with the amount of traversed list items.
 //
 // Note: 
 //    Simpler solution that was considered, but rejected in favor of trying something more
@@ -372,12 +887,20 @@ void LinkedList<T>::SetNextReference(const T data, const T next_data)
 //    No hashing. Traversing through the list and saving visited addresses into
 //    a simple array. Array would be searched before storing new address to see whether the
 //    address is not already there. If so, then the loop is detected.
-template <typename T>
-bool LinkedList<T>::IsLooping_OpenHash(unsigned int hash_table_size)
+template <typename T, typename Allocator, bool LazyDeletion>
+bool LinkedList<T, Allocator, LazyDeletion>::IsLooping_OpenHash(unsigned int hash_table_size)
 {
+    // Hash table types with allocators rebound from the list allocator.
+    using AddressAllocator = typename allocator_traits<Allocator>::template rebind_alloc<uintptr_t>;
+    using HashList = LinkedList<uintptr_t, AddressAllocator>;
+    using HashTableAllocator = typename allocator_traits<Allocator>::template rebind_alloc<HashList>;
+    using HashTableAllocatorTraits = allocator_traits<HashTableAllocator>;
+
     bool loop_found = false;
-    LinkedListItem<T> *p_current = nullptr;         // Pointer used for traversing the list.
-    LinkedList<uintptr_t>* pa_hash_table = nullptr; // Hash array - pointer to array of linked lists.
+    LinkedListItem<T> *p_current = nullptr;     // Pointer used for traversing the list.
+    HashList *pa_hash_table = nullptr;          // Hash array - pointer to array of linked lists.
+    HashTableAllocator hash_table_allocator(this->item_allocator);
+    AddressAllocator address_allocator(this->item_allocator);
     uintptr_t item_address;
 
 
@@ -390,8 +913,12 @@ bool LinkedList<T>::IsLooping_OpenHash(unsigned int hash_table_size)
     // If there is at least one item pointing to some other item in the list (otherwise it doesn't make sense to detect loops).
     if( (this->p_head != nullptr) && (this->p_head->p_next != nullptr) )
     {
-        // Allocate memory for the hash table.
-        pa_hash_table = new LinkedList<uintptr_t>[hash_table_size];
+        // Allocate memory for the hash table and create empty lists using the same memory as the list items.
+        pa_hash_table = HashTableAllocatorTraits::allocate(hash_table_allocator, hash_table_size);
+        for(unsigned int i = 0u; i < hash_table_size; i++)
+        {
+            HashTableAllocatorTraits::construct(hash_table_allocator, &pa_hash_table[i], address_allocator);
+        }
 
         // Set current pointer to the item pointed to by head's next pointer.
         p_current = this->p_head->p_next;
@@ -416,7 +943,12 @@ bool LinkedList<T>::IsLooping_OpenHash(unsigned int hash_table_size)
             loop_found = true;
         }
 
-        delete[] pa_hash_table;
+        // Delete the hash table lists and free the hash table memory.
+        for(unsigned int i = 0u; i < hash_table_size; i++)
+        {
+            HashTableAllocatorTraits::destroy(hash_table_allocator, &pa_hash_table[i]);
+        }
+        HashTableAllocatorTraits::deallocate(hash_table_allocator, pa_hash_table, hash_table_size);
     } // end if( (this->p_head != nullptr) && (this->p_head->p_next != nullptr) )
 
     return loop_found;
@@ -427,8 +959,8 @@ bool LinkedList<T>::IsLooping_OpenHash(unsigned int hash_table_size)
 // This is a bonus looping detection algorithm, that works only if the list items are addded or removing by the
 // assigned methods (AddItemAtEnd, DeleteItem). Despite limitations, its advantage is simplicity and very small
 // memory requirements not rising with the list size.
-template <typename T>
-bool LinkedList<T>::IsLooping_TransitionCount()
+template <typename T, typename Allocator, bool LazyDeletion>
+bool LinkedList<T, Allocator, LazyDeletion>::IsLooping_TransitionCount()
 {
     bool loop_found = false;
     unsigned long transitions_num = 1u;     // Counter of transitions between visited list items.
@@ -442,7 +974,7 @@ bool LinkedList<T>::IsLooping_TransitionCount()
         p_current = this->p_head->p_next;
         // Loop through list items while the end of the list is not found (null pointer) or the 
         // number of transitions between visited list items is above the total number of all list items.
-        while( (p_current != nullptr) && (transitions_num <= this->items_num) )
+        while( (p_current != nullptr) && (transitions_num <= this->GetStoredItemsNum()) )
         {
             p_current = p_current->p_next;
             transitions_num++;
@@ -467,8 +999,8 @@ bool LinkedList<T>::IsLooping_TransitionCount()
 // there is no loop, then the fast pointer simply reaches the end of the loop (null pointer) first and the algorithm
 // can stop.
 // See https://www.codingninjas.com/blog/2020/09/09/floyds-cycle-detection-algorithm/ for more information.
-template <typename T>
-bool LinkedList<T>::IsLooping_FloydsCycleFind()
+template <typename T, typename Allocator, bool LazyDeletion>
+bool LinkedList<T, Allocator, LazyDeletion>::IsLooping_FloydsCycleFind()
 {
     bool loop_found = false;
     LinkedListItem<T> *p_slow = this->p_head;   // Slow pointer moving in list from one item to another.
@@ -492,6 +1024,157 @@ bool LinkedList<T>::IsLooping_FloydsCycleFind()
 }
 
 
+// Enables or disables lazy deletion mode and sets the percentage of deleted items triggering the compaction.
+// In lazy deletion mode the DeleteItem method only marks the item as deleted. All marked items are unlinked and
+// freed at once by the CompactItems method when the percentage of marked items among all stored items reaches
+// the "compaction_deleted_percent" value (values above 100 are limited to 100). Value 0 compacts the list after
+// each deletion, i.e. it behaves the same way as if the lazy deletion was disabled.
+// All items marked as deleted are compacted immediately if the lazy deletion is disabled.
+template <typename T, typename Allocator, bool LazyDeletion>
+void LinkedList<T, Allocator, LazyDeletion>::SetLazyDeletion(bool enabled, unsigned int compaction_deleted_percent)
+{
+    static_assert(LazyDeletion, "Lazy deletion mode requires the LinkedList with LazyDeletion template argument set to true.");
+
+    if(compaction_deleted_percent > 100u)
+    {
+        compaction_deleted_percent = 100u;
+    }
+
+    this->lazy_deletion = enabled;
+    this->compaction_deleted_percent = compaction_deleted_percent;
+
+    if(enabled == false)
+    {
+        this->CompactItems();
+    }
+}
+
+
+// Unlinks and frees all items marked as deleted in lazy deletion mode. The items are unlinked the same way as
+// by the DeleteItem method, but all of them in a single pass through the list.
+// If the list is looping, then the loop is cut first to visit each item only once and restored afterwards, so the
+// last remaining item of the loop points to the first remaining item of the former loop (if there is any).
+template <typename T, typename Allocator, bool LazyDeletion>
+void LinkedList<T, Allocator, LazyDeletion>::CompactItems()
+{
+    LinkedListItem<T> *p_current = nullptr;     // Pointer used for traversing the list.
+    LinkedListItem<T> *p_previous = nullptr;    // Pointer to the last item not marked as deleted.
+    LinkedListItem<T> *p_next = nullptr;        // Temporary pointer to the next item.
+    LinkedListItem<T> *p_loop_start = nullptr;  // First item of the list loop that is not marked as deleted.
+
+
+    if(this->deleted_items_num > 0u)
+    {
+        // Cut the loop (if any) and remember where it should be restored.
+        p_loop_start = this->GetNotDeletedItem(this->CutLoop());
+
+        p_current = this->p_head;
+        while(p_current != nullptr)
+        {
+            p_next = p_current->p_next;
+
+            if(this->IsItemDeleted(p_current))
+            {
+                // Connect previous item (or head) to the item after the current item.
+                if(p_previous != nullptr)
+                {
+                    p_previous->p_next = p_next;
+                }
+                else
+                {
+                    this->p_head = p_next;
+                }
+
+                // Move the tail and the listing pointer away from the deleted item.
+                if(p_current == this->p_tail)
+                {
+                    this->p_tail = p_previous;
+                }
+                if(p_current == this->p_listing)
+                {
+                    this->p_listing = p_next;
+                }
+
+                this->DestroyItem(p_current);
+                this->deleted_items_num--;
+            }
+            else
+            {
+                p_previous = p_current;
+            }
+
+            p_current = p_next;
+        }
+
+        // Restore the loop from the last remaining item.
+        if( (p_loop_start != nullptr) && (p_previous != nullptr) )
+        {
+            p_previous->p_next = p_loop_start;
+        }
+
+        // Items cut-out from the list by a forced loop cannot be found, so they are not counted anymore.
+        this->deleted_items_num = 0u;
+
+        // Free the cloned items block if all its items were deleted.
+        this->DeleteEmptyBlock();
+    } // end if(this->deleted_items_num > 0u)
+}
+
+
+// Returns copy of the allocator used by the list.
+template <typename T, typename Allocator, bool LazyDeletion>
+Allocator LinkedList<T, Allocator, LazyDeletion>::GetAllocator() const
+{
+    return Allocator(this->item_allocator);
+}
+
+
+// Returns lazy view reading all list items. See LinkedListView class for more details.
+template <typename T, typename Allocator, bool LazyDeletion>
+LinkedListView<LinkedListItemsSource<T, Allocator, LazyDeletion>> LinkedList<T, Allocator, LazyDeletion>::View() const
+{
+    return LinkedListView<LinkedListItemsSource<T, Allocator, LazyDeletion>>(LinkedListItemsSource<T, Allocator, LazyDeletion>(*this));
+}
+
+
+// Returns lazy view reading only the list items matching the predicate.
+template <typename T, typename Allocator, bool LazyDeletion>
+template <typename Predicate>
+LinkedListView<LinkedListFilterSource<LinkedListItemsSource<T, Allocator, LazyDeletion>, Predicate>>
+    LinkedList<T, Allocator, LazyDeletion>::Filter(Predicate predicate) const
+{
+    return this->View().Filter(predicate);
+}
+
+
+// Returns lazy view reading the list items transformed by the function.
+template <typename T, typename Allocator, bool LazyDeletion>
+template <typename Function>
+LinkedListView<LinkedListTransformSource<LinkedListItemsSource<T, Allocator, LazyDeletion>, Function>>
+    LinkedList<T, Allocator, LazyDeletion>::Transform(Function function) const
+{
+    return this->View().Transform(function);
+}
+
+
+// Returns lazy view reading at most the specified number of first list items.
+template <typename T, typename Allocator, bool LazyDeletion>
+LinkedListView<LinkedListTakeSource<LinkedListItemsSource<T, Allocator, LazyDeletion>>>
+    LinkedList<T, Allocator, LazyDeletion>::Take(unsigned long items_num) const
+{
+    return this->View().Take(items_num);
+}
+
+
+// Returns lazy view reading the list items after the specified number of first list items.
+template <typename T, typename Allocator, bool LazyDeletion>
+LinkedListView<LinkedListSkipSource<LinkedListItemsSource<T, Allocator, LazyDeletion>>>
+    LinkedList<T, Allocator, LazyDeletion>::Skip(unsigned long items_num) const
+{
+    return this->View().Skip(items_num);
+}
+
+
 // Utility function getting pointer to the current item with the specified data and also pointer to the previous item.
 // If there is no pointer argument specified for the previous item, then only the pointer to the current item is searched.
 // The pointers are returned through pointer to pointer arguments, because the function is returning pointers through pointers
@@ -502,8 +1185,9 @@ bool LinkedList<T>::IsLooping_FloydsCycleFind()
 //    to use only the data types that can be directly compared, otherwise the program won't even compile.
 //    A more complex solution supporting any kind of custom defined data type (e.g. class) would require also implementation of a 
 //    customizable comparison function provided to the linked list class.
-template <typename T>
-void LinkedList<T>::GetCurrentPreviousItemPointer(const T data, LinkedListItem<T> **pp_current_item, LinkedListItem<T> **pp_previous_item)
+template <typename T, typename Allocator, bool LazyDeletion>
+void LinkedList<T, Allocator, LazyDeletion>::GetCurrentPreviousItemPointer(const T data, LinkedListItem<T> **pp_current_item,
+                                                                           LinkedListItem<T> **pp_previous_item)
 {
     unsigned long transitions_num = 1u; // Counter for number of transitions in the list.
 
@@ -524,7 +1208,9 @@ void LinkedList<T>::GetCurrentPreviousItemPointer(const T data, LinkedListItem<T
         // Loop through the list items until the end of the list is detected (null pointer) or the specified data is found or the loop is detected.
         // Loop detection is done in a very simple way by comparing whether the number of transitions between items is smaller than the number of items.
         // This is done to avoid endless while loop when the list is looped and doesn't contain the specified data value.
-        while( (*pp_current_item != nullptr) && ((*pp_current_item)->data != data) && (transitions_num <= this->items_num) )
+        // Items marked as deleted are skipped as if they were not present.
+        while( (*pp_current_item != nullptr) && (((*pp_current_item)->data != data) || this->IsItemDeleted(*pp_current_item)) &&
+               (transitions_num <= this->GetStoredItemsNum()) )
         {
             // If the return pointer for the previous item is provided.
             if(pp_previous_item != nullptr)
@@ -541,7 +1227,7 @@ void LinkedList<T>::GetCurrentPreviousItemPointer(const T data, LinkedListItem<T
 
         // if number of transitions performed is over the number of list items, then the list is probably looped and
         // doesn't contain the specified data value, so set current and previous pointer to null.
-        if(transitions_num > this->items_num)
+        if(transitions_num > this->GetStoredItemsNum())
         {
             *pp_current_item = nullptr;
             if(pp_previous_item != nullptr)
@@ -553,4 +1239,813 @@ void LinkedList<T>::GetCurrentPreviousItemPointer(const T data, LinkedListItem<T
 }
 
 
+// Utility function allocating and constructing new list item with the specified data.
+// Memory is obtained from the list item allocator instead of the "new" operator, so the list can
+// use a custom memory, e.g. arena or polymorphic memory resource.
+template <typename T, typename Allocator, bool LazyDeletion>
+LinkedListItem<T>* LinkedList<T, Allocator, LazyDeletion>::CreateItem(const T data)
+{
+    Item *p_item = ItemAllocatorTraits::allocate(this->item_allocator, 1u);
+
+    try
+    {
+        ItemAllocatorTraits::construct(this->item_allocator, p_item, data);
+    }
+    catch(...)
+    {
+        // Free the memory if the data copy failed, the same way as the "new" operator does.
+        ItemAllocatorTraits::deallocate(this->item_allocator, p_item, 1u);
+        throw;
+    }
+
+    return p_item;
+}
+
+
+// Utility function destroying and deallocating the list item.
+// Items being part of the block allocated by the CloneItems method are only destroyed. Their memory is not
+// reused by the AddItemAtEnd method and stays allocated until the whole block is deallocated at once, i.e.
+// until there are no items stored in the list (see DeleteEmptyBlock method) or until the DeleteAllItems
+// method is called by the destructor or assignment operators.
+template <typename T, typename Allocator, bool LazyDeletion>
+void LinkedList<T, Allocator, LazyDeletion>::DestroyItem(LinkedListItem<T> *p_item)
+{
+    // All list items were created as the Item type, so the pointer can be converted back to it.
+    Item *p_list_item = static_cast<Item *>(p_item);
+    // std::less is used, because it provides total order even for pointers not pointing into the same array.
+    less<const Item*> is_less;
+
+    ItemAllocatorTraits::destroy(this->item_allocator, p_list_item);
+    if( (this->p_block == nullptr) || is_less(p_list_item, this->p_block) ||
+        (is_less(p_list_item, this->p_block + this->block_items_num) == false) )
+    {
+        ItemAllocatorTraits::deallocate(this->item_allocator, p_list_item, 1u);
+    }
+}
+
+
+// Utility function deleting all list items from memory and making the list empty.
+// If the list is looping, then the loop is cut first by setting the next pointer of the last item
+// in the loop to null. Otherwise the items in the loop would be visited and deleted again.
+// Note:
+//    Beware that all the items cut-out before the list loop was created (if there is one) will remain
+//    undeleted in memory, because no mechanism is implemented to find them!
+template <typename T, typename Allocator, bool LazyDeletion>
+void LinkedList<T, Allocator, LazyDeletion>::DeleteAllItems()
+{
+    LinkedListItem<T> *p_current;   // Pointer used for traversing the list.
+    LinkedListItem<T> *p_next;      // Temporary pointer to the next item.
+
+
+    // If the list is looping, then end the list at the last item of the loop.
+    this->CutLoop();
+
+    p_current = this->p_head;
+
+    // Loop through the list until the end of the list is found, i.e. null pointer.
+    while(p_current != nullptr)
+    {
+        // Save next item to temporary pointer.
+        p_next = p_current->p_next;
+        // Delete the current item.
+        this->DestroyItem(p_current);
+        // Move to the next item.
+        p_current = p_next;
+    }
+
+    // Free the memory of the cloned items block. All its items were already destroyed above or by DeleteItem method.
+    if(this->p_block != nullptr)
+    {
+        ItemAllocatorTraits::deallocate(this->item_allocator, this->p_block, this->block_items_num);
+    }
+
+    this->p_head = nullptr;
+    this->p_tail = nullptr;
+    this->p_listing = nullptr;
+    this->items_num = 0u;
+    this->p_block = nullptr;
+    this->block_items_num = 0u;
+    this->deleted_items_num = 0u;
+}
+
+
+// Utility function copying all items of the other list into this empty list.
+// Memory for all cloned items is allocated at once as one block and the items are copied in one linear pass
+// through the other list. The number of items reachable from the other list head can never be greater than
+// its number of items, so the block always has enough space.
+// If the other list is looping, then the copying stops when the first item of the loop is reached again,
+// i.e. each reachable item is copied exactly once and the clone itself is a regular list without loop.
+// Items marked as deleted are not copied. The lazy deletion settings are copied together with the items.
+template <typename T, typename Allocator, bool LazyDeletion>
+void LinkedList<T, Allocator, LazyDeletion>::CloneItems(const LinkedList &other)
+{
+    LinkedListItem<T> *p_current = other.p_head;                    // Pointer used for traversing the other list.
+    LinkedListItem<T> *p_loop_start = other.GetLoopStartItem();     // First item of the other list loop (if any).
+    bool loop_start_passed = false;
+    unsigned long cloned_items_num = 0u;
+
+
+    this->lazy_deletion = other.lazy_deletion;
+    this->compaction_deleted_percent = other.compaction_deleted_percent;
+
+    if( (p_current != nullptr) && (other.items_num > 0u) )
+    {
+        this->p_block = ItemAllocatorTraits::allocate(this->item_allocator, other.items_num);
+        this->block_items_num = other.items_num;
+
+        try
+        {
+            // Loop until the end of the other list or until the loop start item is reached for the second time.
+            while( (p_current != nullptr) && ((p_current != p_loop_start) || (loop_start_passed == false)) &&
+                   (cloned_items_num < this->block_items_num) )
+            {
+                if(p_current == p_loop_start)
+                {
+                    loop_start_passed = true;
+                }
+
+                if(this->IsItemDeleted(p_current) == false)
+                {
+                    ItemAllocatorTraits::construct(this->item_allocator, &this->p_block[cloned_items_num], p_current->data);
+                    // Link the previous cloned item to the new one.
+                    if(cloned_items_num > 0u)
+                    {
+                        this->p_block[cloned_items_num - 1u].p_next = &this->p_block[cloned_items_num];
+                    }
+
+                    cloned_items_num++;
+                }
+                p_current = p_current->p_next;
+            }
+        }
+        catch(...)
+        {
+            // Destroy already cloned items and free the block if the data copy failed.
+            for(unsigned long i = 0u; i < cloned_items_num; i++)
+            {
+                ItemAllocatorTraits::destroy(this->item_allocator, &this->p_block[i]);
+            }
+            ItemAllocatorTraits::deallocate(this->item_allocator, this->p_block, this->block_items_num);
+            this->p_block = nullptr;
+            this->block_items_num = 0u;
+            throw;
+        }
+
+        if(cloned_items_num > 0u)
+        {
+            this->p_head = &this->p_block[0];
+            this->p_tail = &this->p_block[cloned_items_num - 1u];
+            this->p_listing = this->p_head;
+            this->items_num = cloned_items_num;
+        }
+        else
+        {
+            // All reachable items were marked as deleted, so the block is not needed.
+            ItemAllocatorTraits::deallocate(this->item_allocator, this->p_block, this->block_items_num);
+            this->p_block = nullptr;
+            this->block_items_num = 0u;
+        }
+    }
+}
+
+
+// Utility function taking over all items of the other list into this empty list. The other list is left empty.
+// Only the pointers are moved, so it takes O(1) time. Both lists must use equal allocators.
+// The lazy deletion settings are copied together with the items.
+template <typename T, typename Allocator, bool LazyDeletion>
+void LinkedList<T, Allocator, LazyDeletion>::TakeOverItems(LinkedList &other)
+{
+    this->p_head = other.p_head;
+    this->p_tail = other.p_tail;
+    this->p_listing = other.p_listing;
+    this->items_num = other.items_num;
+    this->p_block = other.p_block;
+    this->block_items_num = other.block_items_num;
+    this->lazy_deletion = other.lazy_deletion;
+    this->compaction_deleted_percent = other.compaction_deleted_percent;
+    this->deleted_items_num = other.deleted_items_num;
+
+    other.p_head = nullptr;
+    other.p_tail = nullptr;
+    other.p_listing = nullptr;
+    other.items_num = 0u;
+    other.p_block = nullptr;
+    other.block_items_num = 0u;
+    other.deleted_items_num = 0u;
+}
+
+
+// Utility function freeing the cloned items block if there are no items stored in the list anymore, i.e. all
+// items of the block were already destroyed by the DestroyItem method. Items added to the list after cloning are
+// allocated separately, so they are not affected.
+template <typename T, typename Allocator, bool LazyDeletion>
+void LinkedList<T, Allocator, LazyDeletion>::DeleteEmptyBlock()
+{
+    if( (this->p_block != nullptr) && (this->GetStoredItemsNum() == 0u) )
+    {
+        ItemAllocatorTraits::deallocate(this->item_allocator, this->p_block, this->block_items_num);
+        this->p_block = nullptr;
+        this->block_items_num = 0u;
+        this->p_head = nullptr;
+        this->p_tail = nullptr;
+        this->p_listing = nullptr;
+    }
+}
+
+
+// Utility function getting pointer to the first item of the list loop. Null pointer is returned if the list is not looping.
+// The Floyd's cycle detection algorithm is used to find the item where the slow and fast pointers meet (see
+// IsLooping_FloydsCycleFind method). The distance from the list head to the loop start is then equal to the distance
+// from the meeting item to the loop start (modulo loop length), so two pointers moving by one item from the head
+// and from the meeting item meet exactly at the loop start.
+template <typename T, typename Allocator, bool LazyDeletion>
+LinkedListItem<T>* LinkedList<T, Allocator, LazyDeletion>::GetLoopStartItem() const
+{
+    bool loop_found = false;
+    LinkedListItem<T> *p_slow = this->p_head;   // Slow pointer moving in list from one item to another.
+    LinkedListItem<T> *p_fast = this->p_head;   // Fast pointer moving by two items at once.
+
+
+    // Find the item where the slow and fast pointers meet.
+    while( (loop_found == false) && (p_fast != nullptr) && (p_fast->p_next != nullptr) )
+    {
+        p_slow = p_slow->p_next;
+        p_fast = p_fast->p_next->p_next;
+        if(p_slow == p_fast)
+        {
+            loop_found = true;
+        }
+    }
+
+    if(loop_found)
+    {
+        // Move slow pointer back to the head and move both pointers by one item until they meet at the loop start.
+        p_slow = this->p_head;
+        while(p_slow != p_fast)
+        {
+            p_slow = p_slow->p_next;
+            p_fast = p_fast->p_next;
+        }
+    }
+    else
+    {
+        p_slow = nullptr;
+    }
+
+    return p_slow;
+}
+
+
+// Utility function cutting the list loop (if any) by setting the next pointer of the last item of the loop to null.
+// Returns pointer to the first item of the former loop or null pointer if the list was not looping.
+template <typename T, typename Allocator, bool LazyDeletion>
+LinkedListItem<T>* LinkedList<T, Allocator, LazyDeletion>::CutLoop()
+{
+    LinkedListItem<T> *p_loop_start = this->GetLoopStartItem();
+    LinkedListItem<T> *p_current = p_loop_start;
+
+
+    if(p_loop_start != nullptr)
+    {
+        // Find the last item of the loop, i.e. the one pointing back to the loop start, and end the list there.
+        while(p_current->p_next != p_loop_start)
+        {
+            p_current = p_current->p_next;
+        }
+        p_current->p_next = nullptr;
+    }
+
+    return p_loop_start;
+}
+
+
+// Utility function getting pointer to the first item not marked as deleted starting from the specified item (including it).
+// Null pointer is returned if the end of the list is reached. The number of transitions over the items marked as deleted
+// is limited by the number of items marked as deleted to avoid endless while loop when the list is looped and all items
+// in the loop are marked as deleted. A regular list cannot contain more consecutive items marked as deleted than this
+// number, because the number is always exact: it is reset to zero only by the compaction (and when all items are
+// deleted), and the clone (no items marked as deleted are copied) and move (number is taken over) keep it consistent.
+template <typename T, typename Allocator, bool LazyDeletion>
+LinkedListItem<T>* LinkedList<T, Allocator, LazyDeletion>::GetNotDeletedItem(LinkedListItem<T> *p_item) const
+{
+    unsigned long transitions_num = 0u; // Counter for number of transitions in the list.
+
+
+    while( (p_item != nullptr) && this->IsItemDeleted(p_item) && (transitions_num <= this->deleted_items_num) )
+    {
+        p_item = p_item->p_next;
+        transitions_num++;
+    }
+
+    // If number of transitions performed is over the number of deleted items, then the list is looped and
+    // all items in the loop are marked as deleted.
+    if(transitions_num > this->deleted_items_num)
+    {
+        p_item = nullptr;
+    }
+
+    return p_item;
+}
+
+
+// Utility function returning number of all items stored in the list including the ones marked as deleted.
+template <typename T, typename Allocator, bool LazyDeletion>
+unsigned long LinkedList<T, Allocator, LazyDeletion>::GetStoredItemsNum() const
+{
+    return this->items_num + this->deleted_items_num;
+}
+
+
+// Utility function indicating whether the item is marked as deleted in lazy deletion mode.
+template <typename T, typename Allocator, bool LazyDeletion>
+bool LinkedList<T, Allocator, LazyDeletion>::IsItemDeleted(const LinkedListItem<T> *p_item)
+{
+    return IsItemDeleted(p_item, integral_constant<bool, LazyDeletion>());
+}
+
+
+// Utility function reading the deleted flag of the item, because the list supports lazy deletion.
+template <typename T, typename Allocator, bool LazyDeletion>
+bool LinkedList<T, Allocator, LazyDeletion>::IsItemDeleted(const LinkedListItem<T> *p_item, true_type)
+{
+    return static_cast<const LinkedListDeletableItem<T> *>(p_item)->deleted;
+}
+
+
+// Utility function indicating that the item is not deleted, because the list does not support lazy deletion.
+template <typename T, typename Allocator, bool LazyDeletion>
+bool LinkedList<T, Allocator, LazyDeletion>::IsItemDeleted(const LinkedListItem<T> *, false_type)
+{
+    return false;
+}
+
+
+// Utility function marking the item as deleted in lazy deletion mode.
+template <typename T, typename Allocator, bool LazyDeletion>
+void LinkedList<T, Allocator, LazyDeletion>::SetItemDeleted(LinkedListItem<T> *p_item)
+{
+    SetItemDeleted(p_item, integral_constant<bool, LazyDeletion>());
+}
+
+
+// Utility function setting the deleted flag of the item, because the list supports lazy deletion.
+template <typename T, typename Allocator, bool LazyDeletion>
+void LinkedList<T, Allocator, LazyDeletion>::SetItemDeleted(LinkedListItem<T> *p_item, true_type)
+{
+    static_cast<LinkedListDeletableItem<T> *>(p_item)->deleted = true;
+}
+
+
+// Utility function doing nothing, because the list without lazy deletion support never marks items as deleted.
+template <typename T, typename Allocator, bool LazyDeletion>
+void LinkedList<T, Allocator, LazyDeletion>::SetItemDeleted(LinkedListItem<T> *, false_type)
+{
+}
+
+
+// Utility function replacing the list allocator by the other allocator, because it propagates on assignment.
+// The list must be empty, i.e. it must not hold any items allocated by the current allocator.
+template <typename T, typename Allocator, bool LazyDeletion>
+void LinkedList<T, Allocator, LazyDeletion>::PropagateAllocator(const ItemAllocator &other_allocator, true_type)
+{
+    this->item_allocator = other_allocator;
+}
+
+
+// Utility function keeping the list allocator, because the other allocator does not propagate on assignment.
+// Separate overload is needed, because non-propagating allocators may not be assignable at all (e.g. polymorphic allocator).
+template <typename T, typename Allocator, bool LazyDeletion>
+void LinkedList<T, Allocator, LazyDeletion>::PropagateAllocator(const ItemAllocator &, false_type)
+{
+}
+
+
+// Constructor creating end iterator.
+template <typename Source>
+LinkedListView<Source>::Iterator::Iterator() : p_view(nullptr)
+{
+}
+
+
+// Constructor creating iterator reading the specified view. The view must have the current item already read.
+template <typename Source>
+LinkedListView<Source>::Iterator::Iterator(LinkedListView *p_view) : p_view(p_view)
+{
+}
+
+
+// Returns the data of the current item.
+template <typename Source>
+typename LinkedListView<Source>::Iterator::reference LinkedListView<Source>::Iterator::operator*() const
+{
+    return this->p_view->current_data;
+}
+
+
+// Returns pointer to the data of the current item.
+template <typename Source>
+typename LinkedListView<Source>::Iterator::pointer LinkedListView<Source>::Iterator::operator->() const
+{
+    return &this->p_view->current_data;
+}
+
+
+// Moves to the next item by reading it from the view source.
+template <typename Source>
+typename LinkedListView<Source>::Iterator& LinkedListView<Source>::Iterator::operator++()
+{
+    this->p_view->current_read = this->p_view->source.ReadItem(this->p_view->current_data);
+    return *this;
+}
+
+
+// Moves to the next item and returns proxy holding the data of the previous item (supports "*it++").
+// Input iterator cannot return its previous state, because all copies of the iterator read the same view.
+template <typename Source>
+typename LinkedListView<Source>::Iterator::PostIncrementProxy LinkedListView<Source>::Iterator::operator++(int)
+{
+    PostIncrementProxy proxy(this->p_view->current_data);
+
+    ++(*this);
+
+    return proxy;
+}
+
+
+// Constructor saving the item data.
+template <typename Source>
+LinkedListView<Source>::Iterator::PostIncrementProxy::PostIncrementProxy(reference data) : data(data)
+{
+}
+
+
+// Returns the saved item data.
+template <typename Source>
+typename LinkedListView<Source>::Iterator::reference LinkedListView<Source>::Iterator::PostIncrementProxy::operator*() const
+{
+    return this->data;
+}
+
+
+// Iterators are equal if both are at the end, otherwise only if they are the same iterator.
+template <typename Source>
+bool LinkedListView<Source>::Iterator::operator==(const Iterator &other) const
+{
+    bool iterators_equal = false;
+
+    if(this->IsAtEnd() || other.IsAtEnd())
+    {
+        iterators_equal = (this->IsAtEnd() == other.IsAtEnd());
+    }
+    else
+    {
+        iterators_equal = (this->p_view == other.p_view);
+    }
+
+    return iterators_equal;
+}
+
+
+// Iterators are different if exactly one of them is at the end, otherwise only if they are different iterators.
+template <typename Source>
+bool LinkedListView<Source>::Iterator::operator!=(const Iterator &other) const
+{
+    return !(*this == other);
+}
+
+
+// Indicates whether the iterator is at the end of the view.
+template <typename Source>
+bool LinkedListView<Source>::Iterator::IsAtEnd() const
+{
+    return (this->p_view == nullptr) || (this->p_view->current_read == false);
+}
+
+
+// Constructor creating empty view. Required by the C++20 view concept in older standard libraries.
+template <typename Source>
+LinkedListView<Source>::LinkedListView() : source(), current_data(), current_read(false)
+{
+}
+
+
+// Constructor creating view reading the specified source.
+template <typename Source>
+LinkedListView<Source>::LinkedListView(const Source &source) : source(source), current_data(), current_read(false)
+{
+}
+
+
+// Returns lazy view reading only the items matching the predicate.
+template <typename Source>
+template <typename Predicate>
+LinkedListView<LinkedListFilterSource<Source, Predicate>> LinkedListView<Source>::Filter(Predicate predicate) const
+{
+    return LinkedListView<LinkedListFilterSource<Source, Predicate>>(LinkedListFilterSource<Source, Predicate>(this->source, predicate));
+}
+
+
+// Returns lazy view reading the items transformed by the function.
+template <typename Source>
+template <typename Function>
+LinkedListView<LinkedListTransformSource<Source, Function>> LinkedListView<Source>::Transform(Function function) const
+{
+    return LinkedListView<LinkedListTransformSource<Source, Function>>(LinkedListTransformSource<Source, Function>(this->source, function));
+}
+
+
+// Returns lazy view reading at most the specified number of first items.
+template <typename Source>
+LinkedListView<LinkedListTakeSource<Source>> LinkedListView<Source>::Take(unsigned long items_num) const
+{
+    return LinkedListView<LinkedListTakeSource<Source>>(LinkedListTakeSource<Source>(this->source, items_num));
+}
+
+
+// Returns lazy view reading the items after the specified number of first items.
+template <typename Source>
+LinkedListView<LinkedListSkipSource<Source>> LinkedListView<Source>::Skip(unsigned long items_num) const
+{
+    return LinkedListView<LinkedListSkipSource<Source>>(LinkedListSkipSource<Source>(this->source, items_num));
+}
+
+
+// Reads all remaining items of the view into a new linked list using the specified allocator.
+// This is the only place where the memory is allocated, i.e. only for the items that passed through all chained views.
+template <typename Source>
+template <typename CollectAllocator>
+LinkedList<typename LinkedListView<Source>::value_type, CollectAllocator> LinkedListView<Source>::Collect(const CollectAllocator &allocator)
+{
+    LinkedList<value_type, CollectAllocator> linked_list(allocator);
+    value_type data;
+
+
+    while(this->source.ReadItem(data))
+    {
+        linked_list.AddItemAtEnd(data);
+    }
+
+    return linked_list;
+}
+
+
+// Returns iterator reading the view items. The first item is read from the source right away.
+template <typename Source>
+typename LinkedListView<Source>::Iterator LinkedListView<Source>::begin()
+{
+    this->current_read = this->source.ReadItem(this->current_data);
+    return Iterator(this);
+}
+
+
+// Returns end iterator.
+template <typename Source>
+typename LinkedListView<Source>::Iterator LinkedListView<Source>::end()
+{
+    return Iterator();
+}
+
+
+// Constructor creating source reading no items.
+template <typename T, typename Allocator, bool LazyDeletion>
+LinkedListItemsSource<T, Allocator, LazyDeletion>::LinkedListItemsSource() : p_current(nullptr), transitions_left(0u)
+{
+}
+
+
+// Constructor creating source reading the list from its head item.
+// The number of transitions is limited by the number of all stored items, so the reading of a looped list always ends.
+template <typename T, typename Allocator, bool LazyDeletion>
+LinkedListItemsSource<T, Allocator, LazyDeletion>::LinkedListItemsSource(const LinkedList<T, Allocator, LazyDeletion> &linked_list) :
+    p_current(linked_list.p_head), transitions_left(linked_list.GetStoredItemsNum())
+{
+}
+
+
+// Reads data of the next item not marked as deleted. Return value indicates if the item was read.
+template <typename T, typename Allocator, bool LazyDeletion>
+bool LinkedListItemsSource<T, Allocator, LazyDeletion>::ReadItem(T &data)
+{
+    bool item_read = false;
+
+
+    while( (item_read == false) && (this->p_current != nullptr) && (this->transitions_left > 0u) )
+    {
+        if(LinkedList<T, Allocator, LazyDeletion>::IsItemDeleted(this->p_current) == false)
+        {
+            data = this->p_current->data;
+            item_read = true;
+        }
+
+        this->p_current = this->p_current->p_next;
+        this->transitions_left--;
+    }
+
+    return item_read;
+}
+
+
+// Constructor creating source reading no items. The other source reads no items, so the predicate is never called.
+template <typename Source, typename Predicate>
+LinkedListFilterSource<Source, Predicate>::LinkedListFilterSource() : source(), predicate()
+{
+}
+
+
+// Constructor creating source reading the other source through the predicate.
+template <typename Source, typename Predicate>
+LinkedListFilterSource<Source, Predicate>::LinkedListFilterSource(const Source &source, Predicate predicate) :
+    source(source), predicate(predicate)
+{
+}
+
+
+// Reads data of the next item of the other source matching the predicate. Return value indicates if the item was read.
+template <typename Source, typename Predicate>
+bool LinkedListFilterSource<Source, Predicate>::ReadItem(value_type &data)
+{
+    bool item_read = false;
+
+
+    while( (item_read == false) && this->source.ReadItem(data) )
+    {
+        item_read = this->predicate(static_cast<const value_type &>(data));
+    }
+
+    return item_read;
+}
+
+
+// Constructor creating source reading no items. The other source reads no items, so the function is never called.
+template <typename Source, typename Function>
+LinkedListTransformSource<Source, Function>::LinkedListTransformSource() : source(), function()
+{
+}
+
+
+// Constructor creating source reading the other source through the function.
+template <typename Source, typename Function>
+LinkedListTransformSource<Source, Function>::LinkedListTransformSource(const Source &source, Function function) :
+    source(source), function(function)
+{
+}
+
+
+// Reads data of the next item of the other source transformed by the function. Return value indicates if the item was read.
+template <typename Source, typename Function>
+bool LinkedListTransformSource<Source, Function>::ReadItem(value_type &data)
+{
+    bool item_read = false;
+    typename Source::value_type source_data;
+
+
+    if(this->source.ReadItem(source_data))
+    {
+        data = this->function(static_cast<const typename Source::value_type &>(source_data));
+        item_read = true;
+    }
+
+    return item_read;
+}
+
+
+// Constructor creating source reading no items.
+template <typename Source>
+LinkedListTakeSource<Source>::LinkedListTakeSource() : source(), items_left(0u)
+{
+}
+
+
+// Constructor creating source reading at most the specified number of items of the other source.
+template <typename Source>
+LinkedListTakeSource<Source>::LinkedListTakeSource(const Source &source, unsigned long items_num) :
+    source(source), items_left(items_num)
+{
+}
+
+
+// Reads data of the next item of the other source unless the specified number of items was already read.
+// The other source is not read at all after that, so the reading stops even if the other source never ends.
+// Return value indicates if the item was read.
+template <typename Source>
+bool LinkedListTakeSource<Source>::ReadItem(value_type &data)
+{
+    bool item_read = false;
+
+
+    if( (this->items_left > 0u) && this->source.ReadItem(data) )
+    {
+        this->items_left--;
+        item_read = true;
+    }
+
+    return item_read;
+}
+
+
+// Constructor creating source reading no items.
+template <typename Source>
+LinkedListSkipSource<Source>::LinkedListSkipSource() : source(), items_to_skip(0u)
+{
+}
+
+
+// Constructor creating source skipping the specified number of first items of the other source.
+template <typename Source>
+LinkedListSkipSource<Source>::LinkedListSkipSource(const Source &source, unsigned long items_num) :
+    source(source), items_to_skip(items_num)
+{
+}
+
+
+// Reads data of the next item of the other source after skipping the specified number of first items.
+// Return value indicates if the item was read.
+template <typename Source>
+bool LinkedListSkipSource<Source>::ReadItem(value_type &data)
+{
+    // Skip the first items during the first reading.
+    while( (this->items_to_skip > 0u) && this->source.ReadItem(data) )
+    {
+        this->items_to_skip--;
+    }
+    // Source ended before all items were skipped, so do not try skipping again.
+    this->items_to_skip = 0u;
+
+    return this->source.ReadItem(data);
+}
+
+
+// Constructor creating empty wrapper. Empty wrapper must not be called.
+template <typename Function>
+LinkedListFunctionBox<Function>::LinkedListFunctionBox() : p_function(nullptr)
+{
+}
+
+
+// Constructor storing copy of the function object.
+template <typename Function>
+LinkedListFunctionBox<Function>::LinkedListFunctionBox(const Function &function) :
+    p_function(::new(static_cast<void *>(this->a_storage)) Function(function))
+{
+}
+
+
+// Copy constructor storing copy of the other function object.
+template <typename Function>
+LinkedListFunctionBox<Function>::LinkedListFunctionBox(const LinkedListFunctionBox &other) : p_function(nullptr)
+{
+    if(other.p_function != nullptr)
+    {
+        this->p_function = ::new(static_cast<void *>(this->a_storage)) Function(*other.p_function);
+    }
+}
+
+
+// Destructor destroying the stored function object.
+template <typename Function>
+LinkedListFunctionBox<Function>::~LinkedListFunctionBox()
+{
+    this->DestroyFunction();
+}
+
+
+// Copy assignment replacing the stored function object by copy of the other function object.
+// If the copy throws an exception, the wrapper is left empty.
+template <typename Function>
+LinkedListFunctionBox<Function>& LinkedListFunctionBox<Function>::operator=(const LinkedListFunctionBox &other)
+{
+    if(this != &other)
+    {
+        this->DestroyFunction();
+        if(other.p_function != nullptr)
+        {
+            this->p_function = ::new(static_cast<void *>(this->a_storage)) Function(*other.p_function);
+        }
+    }
+
+    return *this;
+}
+
+
+// Calls the stored function object with the specified arguments.
+template <typename Function>
+template <typename... Arguments>
+auto LinkedListFunctionBox<Function>::operator()(Arguments &&...arguments) -> decltype(declval<Function &>()(declval<Arguments>()...))
+{
+    return (*this->p_function)(forward<Arguments>(arguments)...);
+}
+
+
+// Utility function destroying the stored function object (if any) and making the wrapper empty.
+template <typename Function>
+void LinkedListFunctionBox<Function>::DestroyFunction()
+{
+    if(this->p_function != nullptr)
+    {
+        this->p_function->~Function();
+        this->p_function = nullptr;
+    }
+}
+
+
 #endif // #ifndef LINKED_LIST_H
\ No newline at end of file
@@ -22,6 +22,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include <iostream>
 #include <string>
 #include "linked_list.h"
+#include "static_linked_list.h"
 
 
 using namespace std;
@@ -30,15 +31,27 @@ using namespace std;
 // FUNCTION DECLARATIONS
 // *************************************************************************************************
 // Prints data from all linked list items.
-template <typename T>
-void PrintLinkedListData(LinkedList<T> &, unsigned long=100u);
+template <typename T, typename Allocator, bool LazyDeletion>
+void PrintLinkedListData(LinkedList<T, Allocator, LazyDeletion> &, unsigned long=100u);
 // Performs all available loop detections and prints results.
-template <typename T>
-void PerformLoopDetections(LinkedList<T> &);
+template <typename T, typename Allocator, bool LazyDeletion>
+void PerformLoopDetections(LinkedList<T, Allocator, LazyDeletion> &);
 // Linked list usage demonstration with integer data type.
 void DemonstrateLinkedList_int();
 // Linked list usage demonstration with string data type.
 void DemonstrateLinkedList_str();
+// Linked list usage demonstration with lazy deletion mode.
+void DemonstrateLinkedList_lazy();
+// Linked list usage demonstration with lazy views.
+void DemonstrateLinkedList_views();
+#ifdef LINKED_LIST_PMR_AVAILABLE
+// Linked list usage demonstration with items allocated from a polymorphic memory resource.
+void DemonstrateLinkedList_pmr();
+#endif
+// Builds a static linked list with integer values at compile time.
+constexpr StaticLinkedList<int, 8u> BuildStaticLinkedList_int(bool);
+// Static linked list usage demonstration with integer data type.
+void DemonstrateStaticLinkedList_int();
 
 // *************************************************************************************************
 // FUNCTION DEFINITIONS
@@ -46,8 +59,8 @@ void DemonstrateLinkedList_str();
 // Prints data from all items of the specified linked list to the console.
 // Maximum amount of printed data values can be limited by the max_printed_data_num argument to
 // avoid endless printing of a looped list.
-template <typename T>
-void PrintLinkedListData(LinkedList<T> &linked_list, unsigned long max_printed_data_num)
+template <typename T, typename Allocator, bool LazyDeletion>
+void PrintLinkedListData(LinkedList<T, Allocator, LazyDeletion> &linked_list, unsigned long max_printed_data_num)
 {
    T data;
    bool list_continues = true;
@@ -91,8 +104,8 @@ void PrintLinkedListData(LinkedList<T> &linked_list, unsigned long max_printed_d
 
 
 // Performs all available loop detections and prints results to the console.
-template <typename T>
-void PerformLoopDetections(LinkedList<T> &linked_list)
+template <typename T, typename Allocator, bool LazyDeletion>
+void PerformLoopDetections(LinkedList<T, Allocator, LazyDeletion> &linked_list)
 {
    bool a_results[3];   // Array for loop detection algorithms results.
    string a_loop_detect_algo_name[3] =
@@ -165,6 +178,15 @@ void DemonstrateLinkedList_int()
    PrintLinkedListData<int>(int_linked_list, 20);
    PerformLoopDetections<int>(int_linked_list);
    //---
+
+   //--- Clone the looped list and move the clone into another list. Each item reachable from the list head
+   // is cloned only once, so the clone is not looping. Moving only takes over the items of the clone.
+   cout << endl << "Cloning the looped list and moving the clone." << endl;
+   LinkedList<int> int_linked_list_clone(int_linked_list);
+   LinkedList<int> int_linked_list_moved(move(int_linked_list_clone));
+   PrintLinkedListData<int>(int_linked_list_moved, 20);
+   PerformLoopDetections<int>(int_linked_list_moved);
+   //---
 }
 
 
@@ -202,11 +224,154 @@ void DemonstrateLinkedList_str()
 }
 
 
+// Linked list usage demonstration with lazy deletion mode. Deleted items are only marked as deleted
+// until they reach 50 % of all stored items. Then they are all freed at once.
+void DemonstrateLinkedList_lazy()
+{
+   LazyDeletionLinkedList<int> lazy_linked_list;
+
+   lazy_linked_list.SetLazyDeletion(true, 50u);
+
+   cout << endl << "Generating linked list holding integer values 0-9 with lazy deletion." << endl;
+   for(int i = 0; i < 10; i++)
+   {
+      lazy_linked_list.AddItemAtEnd(i);
+   }
+   PrintLinkedListData<int>(lazy_linked_list);
+
+   //--- Remove some items. They are only marked as deleted and skipped.
+   cout << endl << "Removing values 0, 3, 7, 9 (marked as deleted)." << endl;
+   lazy_linked_list.DeleteItem(0);
+   lazy_linked_list.DeleteItem(3);
+   lazy_linked_list.DeleteItem(7);
+   lazy_linked_list.DeleteItem(9);
+   PrintLinkedListData<int>(lazy_linked_list);
+   cout << "Items: " << lazy_linked_list.GetItemsNum() << ", value 3 present: " << lazy_linked_list.IsItemPresent(3) << endl;
+   //---
+
+   //--- Remove another item reaching 50 % of deleted items, which triggers the compaction.
+   cout << endl << "Removing value 5 (compaction of all deleted items)." << endl;
+   lazy_linked_list.DeleteItem(5);
+   PrintLinkedListData<int>(lazy_linked_list);
+   PerformLoopDetections<int>(lazy_linked_list);
+   //---
+}
+
+
+// Linked list usage demonstration with lazy views. Chained views read the list in a single traversal
+// and allocate memory only for the items of the collected list.
+void DemonstrateLinkedList_views()
+{
+   LinkedList<int> int_linked_list;
+
+   cout << endl << "Generating linked list holding integer values 0-9." << endl;
+   for(int i = 0; i < 10; i++)
+   {
+      int_linked_list.AddItemAtEnd(i);
+   }
+   PrintLinkedListData<int>(int_linked_list);
+
+   //--- Collect first 3 squares of the even values except the first one.
+   cout << endl << "Collecting first 3 squares of the even values except the first one." << endl;
+   LinkedList<int> squares_linked_list = int_linked_list.Filter([](int data) { return (data % 2) == 0; })
+                                                        .Transform([](int data) { return data * data; })
+                                                        .Skip(1u)
+                                                        .Take(3u)
+                                                        .Collect();
+   PrintLinkedListData<int>(squares_linked_list);
+   //---
+
+   //--- Read the looped list using a range-based for loop. Reading stops after the number of transitions
+   // equal to the number of list items, so it does not continue endlessly.
+   cout << endl << "Forcing link from value 9 to value 5 and reading the looped list." << endl;
+   int_linked_list.SetNextReference(9, 5);
+   cout << "List data: ";
+   for(int data : int_linked_list.View())
+   {
+      cout << data << " ";
+   }
+   cout << endl;
+   //---
+}
+
+
+#ifdef LINKED_LIST_PMR_AVAILABLE
+// Linked list usage demonstration with items allocated from a polymorphic memory resource.
+// All list items and the scratch hash table used by the loop detection are placed into the local
+// buffer by the monotonic buffer resource, which releases everything at once when it is destroyed.
+void DemonstrateLinkedList_pmr()
+{
+   unsigned char a_buffer[4096];
+   pmr::monotonic_buffer_resource arena(a_buffer, sizeof(a_buffer), pmr::null_memory_resource());
+   PmrLinkedList<int> pmr_linked_list(&arena);
+
+   cout << endl << "Generating linked list holding integer values 0-9 in a local memory buffer." << endl;
+   for(int i = 0; i < 10; i++)
+   {
+      pmr_linked_list.AddItemAtEnd(i);
+   }
+   PrintLinkedListData<int>(pmr_linked_list);
+   PerformLoopDetections<int>(pmr_linked_list);
+}
+#endif
+
+
+// Builds a static linked list with integer values 0-5 at compile time. Value 3 is deleted and
+// replaced by value 6 at the end of the list. If the "loop" argument is true, then the link from
+// value 6 to value 2 is forced, creating a looped list.
+constexpr StaticLinkedList<int, 8u> BuildStaticLinkedList_int(bool loop)
+{
+   StaticLinkedList<int, 8u> static_linked_list;
+
+   for(int i = 0; i < 6; i++)
+   {
+      static_linked_list.AddItemAtEnd(i);
+   }
+   static_linked_list.DeleteItem(3);
+   static_linked_list.AddItemAtEnd(6);
+   if(loop)
+   {
+      static_linked_list.SetNextReference(6, 2);
+   }
+
+   return static_linked_list;
+}
+
+
+// Static linked list usage demonstration with integer data type.
+// The lists are built and checked for loops at compile time, so there is no runtime cost.
+void DemonstrateStaticLinkedList_int()
+{
+   constexpr StaticLinkedList<int, 8u> static_linked_list = BuildStaticLinkedList_int(false);
+   constexpr StaticLinkedList<int, 8u> static_looped_list = BuildStaticLinkedList_int(true);
+
+   static_assert(static_linked_list.GetItemsNum() == 6u, "Unexpected number of static list items.");
+   static_assert(static_linked_list.IsItemPresent(3) == false, "Deleted value 3 is still present.");
+   static_assert(static_linked_list.IsItemPresent(6), "Value 6 is not present.");
+   static_assert(static_linked_list.IsLooping_FloydsCycleFind() == false, "Static list is looping.");
+   static_assert(static_looped_list.IsLooping_FloydsCycleFind(), "Static list is not looping.");
+
+   cout << endl << "Static linked list with values 0-5 built at compile time, value 3 replaced by 6." << endl;
+   cout << "Items: " << static_linked_list.GetItemsNum() << " of capacity " << static_linked_list.GetCapacity() << endl;
+   cout << "Loop detection using Floyd's cycle finding: " <<
+      (static_linked_list.IsLooping_FloydsCycleFind() ? "WARNING! Looping detected!" : "OK. No looping.") << endl;
+   cout << "Forced link from value 6 to value 2 at compile time." << endl;
+   cout << "Loop detection using Floyd's cycle finding: " <<
+      (static_looped_list.IsLooping_FloydsCycleFind() ? "WARNING! Looping detected!" : "OK. No looping.") << endl;
+}
+
+
 int main()
 {
    //--- Perform functions demonstrating linked list usage.
    DemonstrateLinkedList_int();
    DemonstrateLinkedList_str();
+   DemonstrateLinkedList_lazy();
+   DemonstrateLinkedList_views();
+#ifdef LINKED_LIST_PMR_AVAILABLE
+   DemonstrateLinkedList_pmr();
+#endif
+   DemonstrateStaticLinkedList_int();
    //---
 
    // Wait for any keyboard input to prevent automatic closing of the Windows console print-out.
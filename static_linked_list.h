@@ -0,0 +1,425 @@
+/*
+Static (fixed-capacity) linked list C++ class template.
+
+Copyright (C) 2024 Lubomir Milko
+This file is part of C++ linked list implementation
+<https://github.com/lubomilko/linked_list_cpp>.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef STATIC_LINKED_LIST_H
+#define STATIC_LINKED_LIST_H
+
+
+// *************************************************************************************************
+// CLASS DECLARATIONS
+// *************************************************************************************************
+// Forward declaration of StaticLinkedList class so it can be specified as a friend in StaticLinkedListItem class.
+template <typename T, unsigned long Capacity>
+class StaticLinkedList;
+
+template <typename T>
+// Class representing one item of the static linked list.
+// The items are not linked by pointers, but by indexes into the internal item array of the list.
+// Indexes stay valid even if the whole list object is copied, e.g. when it is returned from
+// a constexpr function, which would not be the case for pointers.
+class StaticLinkedListItem
+{
+    // Ensuring that the static linked list class has access to the private attributes of the item.
+    template <typename, unsigned long>
+    friend class StaticLinkedList;
+
+    public:
+        // Constructor creating an unlinked item with default data value.
+        constexpr StaticLinkedListItem();
+
+    private:
+        // Data held within the list item.
+        // Note:
+        //    The data type must be default constructible (items are preallocated in an array) and
+        //    comparable using "==" or "!=" operator. For usage in constexpr context it must also
+        //    be a literal type.
+        T data;
+        // Index of the next linked list item in the item array of the list.
+        unsigned long next_index;
+};
+
+
+// Linked list class with a fixed capacity keeping all items in an internal array, i.e. without any
+// heap allocation. All methods are constexpr, so the list can be built and checked for loops at compile time:
+//
+//     constexpr StaticLinkedList<int, 8u> BuildTable() { StaticLinkedList<int, 8u> l; l.AddItemAtEnd(1); return l; }
+//     static_assert(BuildTable().IsLooping_FloydsCycleFind() == false, "Table is looping.");
+//
+// Deleted items are returned into the list of free items and reused by the following AddItemAtEnd calls.
+// Requires at least C++14 (constexpr methods with loops).
+template <typename T, unsigned long Capacity>
+class StaticLinkedList
+{
+    static_assert(Capacity > 0u, "StaticLinkedList capacity must be at least 1.");
+
+    public:
+        // Constructor creating empty list with all items free.
+        constexpr StaticLinkedList();
+        // Adds item with specified data at the end of the list.
+        // Return value indicates if the item was added, i.e. if the list was not full.
+        constexpr bool AddItemAtEnd(const T);
+        // Deletes first instance of an item having the specified data value.
+        constexpr void DeleteItem(const T);
+        // Get data of the next item through the reference argument.
+        // Return value indicates if there are further items to be read, i.e. if the list still continues.
+        constexpr bool GetNextItem(T &);
+        // Moves reading index used by GetNextItem method back to the list head item.
+        constexpr void ResetReading();
+        // Indicates whether item with specified data is present.
+        constexpr bool IsItemPresent(const T) const;
+        // Returns number of items in the linked list.
+        constexpr unsigned long GetItemsNum() const;
+        // Returns maximum number of items the linked list can hold.
+        static constexpr unsigned long GetCapacity();
+        // Forcing a link from one item to another. To be used only for intentional creation of looped list.
+        constexpr void SetNextReference(const T, const T);
+        // Indicates if list is looping detection by counting the number of transitions made when traversing the list.
+        constexpr bool IsLooping_TransitionCount() const;
+        // Indicates if list is looping using Floyd's cycle detection algorithm.
+        constexpr bool IsLooping_FloydsCycleFind() const;
+
+    private:
+        // Index value representing a null pointer, i.e. no item.
+        static constexpr unsigned long NULL_INDEX = Capacity;
+
+        // Array holding all list items, both used and free ones.
+        StaticLinkedListItem<T> a_items[Capacity];
+        // Indexes of the linked list head and tail.
+        unsigned long head_index;
+        unsigned long tail_index;
+        // Index of the linked list item used by GetNextItem method.
+        unsigned long listing_index;
+        // Index of the first free item. Free items are linked together by their next indexes.
+        unsigned long free_index;
+        // Number of items in a list.
+        unsigned long items_num;
+
+        // Utility function getting index of the current item with the specified data and also index of the previous item.
+        constexpr void GetCurrentPreviousItemIndex(const T, unsigned long *, unsigned long * = nullptr) const;
+};
+
+
+// *************************************************************************************************
+// CLASS DEFINITIONS
+// *************************************************************************************************
+// Constructor creating an unlinked item with default data value.
+template <typename T>
+constexpr StaticLinkedListItem<T>::StaticLinkedListItem() : data(), next_index(0u)
+{
+}
+
+
+// Constructor creating empty list with all items free.
+template <typename T, unsigned long Capacity>
+constexpr StaticLinkedList<T, Capacity>::StaticLinkedList() :
+    a_items(), head_index(NULL_INDEX), tail_index(NULL_INDEX), listing_index(NULL_INDEX), free_index(0u), items_num(0u)
+{
+    // Link all items into the list of free items: 0 -> 1 -> ... -> Capacity - 1 -> null.
+    for(unsigned long i = 0u; i < Capacity; i++)
+    {
+        this->a_items[i].next_index = i + 1u;
+    }
+}
+
+
+// Adds item with specified data at the end of the list.
+// The item is taken from the list of free items. If there is no free item left, the list remains
+// unchanged and false is returned.
+template <typename T, unsigned long Capacity>
+constexpr bool StaticLinkedList<T, Capacity>::AddItemAtEnd(const T data)
+{
+    bool item_added = false;
+    unsigned long new_index = this->free_index;
+
+
+    // If there is a free item available.
+    if(new_index != NULL_INDEX)
+    {
+        // Remove the item from the list of free items and initialize it.
+        this->free_index = this->a_items[new_index].next_index;
+        this->a_items[new_index].data = data;
+        this->a_items[new_index].next_index = NULL_INDEX;
+
+        // Check if list is empty, i.e. head index is null.
+        if(this->head_index == NULL_INDEX)
+        {
+            // Add first item of the list.
+            this->head_index = new_index;
+            this->tail_index = new_index;
+            this->listing_index = this->head_index;
+        }
+        else
+        {
+            // Add new item to the end of the list.
+            this->a_items[this->tail_index].next_index = new_index;
+            this->tail_index = new_index;
+        }
+
+        this->items_num++;
+        item_added = true;
+    }
+
+    return item_added;
+}
+
+
+// Deletes first instance of an item having the specified data value.
+// The deleted item is returned to the beginning of the list of free items.
+template <typename T, unsigned long Capacity>
+constexpr void StaticLinkedList<T, Capacity>::DeleteItem(const T data_to_delete)
+{
+    unsigned long current_index = NULL_INDEX;
+    unsigned long previous_index = NULL_INDEX;
+
+    // Get index of the current and previous item for the specified data value.
+    this->GetCurrentPreviousItemIndex(data_to_delete, &current_index, &previous_index);
+
+    // If current item having specified data value was found.
+    if(current_index != NULL_INDEX)
+    {
+        // If previous item before the one with specified data was found.
+        if(previous_index != NULL_INDEX)
+        {
+            // Connect previous item to the item after current item.
+            this->a_items[previous_index].next_index = this->a_items[current_index].next_index;
+
+            // If current item being removed is the tail of the list.
+            if(current_index == this->tail_index)
+            {
+                // Move the tail to the previous item.
+                this->tail_index = previous_index;
+            }
+        }
+        else
+        {
+            // The first list item is being deleted, so connect head to the item right after the current item.
+            this->head_index = this->a_items[current_index].next_index;
+            if(this->head_index == NULL_INDEX)
+            {
+                this->tail_index = NULL_INDEX;
+            }
+        }
+
+        // Move the reading index away from the deleted item.
+        if(this->listing_index == current_index)
+        {
+            this->listing_index = this->a_items[current_index].next_index;
+        }
+
+        // Return the deleted item to the list of free items.
+        this->a_items[current_index].next_index = this->free_index;
+        this->free_index = current_index;
+
+        if(this->items_num > 0u)
+        {
+            this->items_num--;
+        }
+    } // end if(current_index != NULL_INDEX)
+}
+
+
+// Get data of the next item through the reference argument. Behaves the same way as LinkedList::GetNextItem,
+// i.e. keeps returning the last item data after the end of the list is reached until the reading is reset.
+// Return value indicates if there are further items to be read, i.e. if the list still continues.
+template <typename T, unsigned long Capacity>
+constexpr bool StaticLinkedList<T, Capacity>::GetNextItem(T &data)
+{
+    bool list_continues = false;    // Flag indicating whether there are further items to be read.
+
+    if(this->listing_index != NULL_INDEX)
+    {
+        // Set data value pointed to by the listing index.
+        data = this->a_items[this->listing_index].data;
+        // Move the listing index to the next item unless it's already at the end.
+        if(this->a_items[this->listing_index].next_index != NULL_INDEX)
+        {
+            this->listing_index = this->a_items[this->listing_index].next_index;
+            list_continues = true;
+        }
+    }
+
+    return list_continues;
+}
+
+
+// Moves reading index used by GetNextItem method back to the list head item.
+template <typename T, unsigned long Capacity>
+constexpr void StaticLinkedList<T, Capacity>::ResetReading()
+{
+    this->listing_index = this->head_index;
+}
+
+
+// Indicates whether item with specified data is present.
+template <typename T, unsigned long Capacity>
+constexpr bool StaticLinkedList<T, Capacity>::IsItemPresent(const T data) const
+{
+    unsigned long current_index = NULL_INDEX;
+
+    // Get index of the item with specified data value.
+    this->GetCurrentPreviousItemIndex(data, &current_index);
+
+    return (current_index != NULL_INDEX);
+}
+
+
+// Returns number of items in the linked list.
+template <typename T, unsigned long Capacity>
+constexpr unsigned long StaticLinkedList<T, Capacity>::GetItemsNum() const
+{
+    return this->items_num;
+}
+
+
+// Returns maximum number of items the linked list can hold.
+template <typename T, unsigned long Capacity>
+constexpr unsigned long StaticLinkedList<T, Capacity>::GetCapacity()
+{
+    return Capacity;
+}
+
+
+// Forcing a link from one item to another. To be used only for intentional creation of looped list.
+// Next index of the item with specified "data" value will be set to the index of the item with specified
+// "next_data" value.
+template <typename T, unsigned long Capacity>
+constexpr void StaticLinkedList<T, Capacity>::SetNextReference(const T data, const T next_data)
+{
+    unsigned long current_index = NULL_INDEX;
+    unsigned long next_index = NULL_INDEX;
+
+    // Get indexes of the items with specified data values.
+    this->GetCurrentPreviousItemIndex(data, &current_index);
+    this->GetCurrentPreviousItemIndex(next_data, &next_index);
+
+    // If indexes of both items were found.
+    if( (current_index != NULL_INDEX) && (next_index != NULL_INDEX) )
+    {
+        // Link the two items.
+        this->a_items[current_index].next_index = next_index;
+    }
+}
+
+
+// Indicates if list is looping detection by counting the number of transitions made when traversing the list.
+// See LinkedList::IsLooping_TransitionCount for more information.
+template <typename T, unsigned long Capacity>
+constexpr bool StaticLinkedList<T, Capacity>::IsLooping_TransitionCount() const
+{
+    unsigned long transitions_num = 1u;         // Counter of transitions between visited list items.
+    unsigned long current_index = NULL_INDEX;   // Index used for traversing the list.
+
+
+    // If there is at least one item pointing to some other item in the list.
+    if( (this->head_index != NULL_INDEX) && (this->a_items[this->head_index].next_index != NULL_INDEX) )
+    {
+        current_index = this->a_items[this->head_index].next_index;
+        // Loop through list items while the end of the list is not found or the number of
+        // transitions between visited list items is above the total number of all list items.
+        while( (current_index != NULL_INDEX) && (transitions_num <= this->items_num) )
+        {
+            current_index = this->a_items[current_index].next_index;
+            transitions_num++;
+        }
+    }
+
+    // If the end of the list was not found, then the list loops.
+    return (current_index != NULL_INDEX);
+}
+
+
+// Indicates if list is looping using Floyd's cycle detection algorithm.
+// See LinkedList::IsLooping_FloydsCycleFind for more information.
+template <typename T, unsigned long Capacity>
+constexpr bool StaticLinkedList<T, Capacity>::IsLooping_FloydsCycleFind() const
+{
+    bool loop_found = false;
+    unsigned long slow_index = this->head_index;    // Slow index moving in list from one item to another.
+    unsigned long fast_index = this->head_index;    // Fast index moving by two items at once.
+
+
+    // Loop while the loop is not found (slow and fast index different) or the end of the list is not found.
+    while( (loop_found == false) && (slow_index != NULL_INDEX) && (fast_index != NULL_INDEX) &&
+           (this->a_items[fast_index].next_index != NULL_INDEX) )
+    {
+        // Move slow index by one item and fast index by two items.
+        slow_index = this->a_items[slow_index].next_index;
+        fast_index = this->a_items[this->a_items[fast_index].next_index].next_index;
+        // If fast index catches slow index, then loop must exist.
+        if(slow_index == fast_index)
+        {
+            loop_found = true;
+        }
+    }
+
+    return loop_found;
+}
+
+
+// Utility function getting index of the current item with the specified data and also index of the previous item.
+// If there is no pointer argument specified for the previous item, then only the index of the current item is searched.
+// Null index is returned if the item is not found. Looped lists are handled the same way as in
+// LinkedList::GetCurrentPreviousItemPointer, i.e. by limiting the number of transitions to the number of items.
+template <typename T, unsigned long Capacity>
+constexpr void StaticLinkedList<T, Capacity>::GetCurrentPreviousItemIndex(const T data, unsigned long *p_current_index,
+                                                                          unsigned long *p_previous_index) const
+{
+    unsigned long transitions_num = 1u; // Counter for number of transitions in the list.
+
+
+    // If the return pointer for the current item index is provided.
+    if(p_current_index != nullptr)
+    {
+        if(p_previous_index != nullptr)
+        {
+            *p_previous_index = NULL_INDEX;
+        }
+
+        *p_current_index = this->head_index;
+
+        // Loop through the list items until the end of the list is detected or the specified data is found or the loop is detected.
+        while( (*p_current_index != NULL_INDEX) && (this->a_items[*p_current_index].data != data) &&
+               (transitions_num <= this->items_num) )
+        {
+            if(p_previous_index != nullptr)
+            {
+                *p_previous_index = *p_current_index;
+            }
+
+            *p_current_index = this->a_items[*p_current_index].next_index;
+            transitions_num++;
+        }
+
+        // If number of transitions performed is over the number of list items, then the list is probably looped and
+        // doesn't contain the specified data value, so set current and previous index to null.
+        if(transitions_num > this->items_num)
+        {
+            *p_current_index = NULL_INDEX;
+            if(p_previous_index != nullptr)
+            {
+                *p_previous_index = NULL_INDEX;
+            }
+        }
+    } // end if(p_current_index != nullptr)
+}
+
+
+#endif // #ifndef STATIC_LINKED_LIST_H